@@ -0,0 +1,141 @@
+/*
+  ==============================================================================
+
+    JUCE-free DSP core of the Initializer plugin.
+
+    Everything in here works on raw channel pointers and a plain parameter
+    struct, so it can be used outside of a juce::AudioProcessor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+
+namespace InitializerDSP
+{
+    //==============================================================================
+    /** Which part of the stereo image is passed through. */
+    enum class SoloMode
+    {
+        stereo,
+        mid,
+        side,
+        left,
+        right
+    };
+
+    /** Plain parameter set, mirroring the plugin's parameter layout. */
+    struct Parameters
+    {
+        float gainDecibels = 0.0f;
+        bool phaseReverse = false;
+        bool stereoFlip = false;
+        SoloMode solo = SoloMode::stereo;
+    };
+
+    /** Gains at or below this level are treated as silence (same as juce::Decibels). */
+    constexpr float minusInfinityDb = -100.0f;
+
+    inline float decibelsToGain(float decibels)
+    {
+        return decibels > minusInfinityDb ? std::pow(10.0f, decibels * 0.05f) : 0.0f;
+    }
+
+    //==============================================================================
+    /**
+        The whole per-sample processing expressed as a 2x2 routing matrix with
+        the trim already folded in:
+
+            outLeft  = leftFromLeft  * inLeft + leftFromRight  * inRight
+            outRight = rightFromLeft * inLeft + rightFromRight * inRight
+
+        For mono input only the mono coefficient is used.
+    */
+    struct RoutingMatrix
+    {
+        float leftFromLeft = 1.0f;
+        float leftFromRight = 0.0f;
+        float rightFromLeft = 0.0f;
+        float rightFromRight = 1.0f;
+        float mono = 1.0f;
+    };
+
+    inline RoutingMatrix makeRoutingMatrix(const Parameters& params)
+    {
+        RoutingMatrix m;
+
+        switch (params.solo)
+        {
+            case SoloMode::mid:   m = { 0.5f,  0.5f,  0.5f, 0.5f }; break;
+            case SoloMode::side:  m = { 0.5f, -0.5f, -0.5f, 0.5f }; break;
+            case SoloMode::left:  m = { 1.0f,  0.0f,  0.0f, 0.0f }; break;
+            case SoloMode::right: m = { 0.0f,  0.0f,  0.0f, 1.0f }; break;
+            case SoloMode::stereo:
+            default:              m = { 1.0f,  0.0f,  0.0f, 1.0f }; break;
+        }
+
+        // phase reverse takes precedence over stereo flip
+        if (params.phaseReverse)
+        {
+            m.leftFromLeft = -m.leftFromLeft;
+            m.leftFromRight = -m.leftFromRight;
+            m.rightFromLeft = -m.rightFromLeft;
+            m.rightFromRight = -m.rightFromRight;
+        }
+        else if (params.stereoFlip)
+        {
+            RoutingMatrix flipped = m;
+            m.leftFromLeft = flipped.rightFromLeft;
+            m.leftFromRight = flipped.rightFromRight;
+            m.rightFromLeft = flipped.leftFromLeft;
+            m.rightFromRight = flipped.leftFromRight;
+        }
+
+        auto gain = decibelsToGain(params.gainDecibels);
+
+        m.leftFromLeft *= gain;
+        m.leftFromRight *= gain;
+        m.rightFromLeft *= gain;
+        m.rightFromRight *= gain;
+        m.mono = (params.phaseReverse ? -1.0f : 1.0f) * gain;
+
+        return m;
+    }
+
+    //==============================================================================
+    /**
+        Applies the routing matrix in place. Only mono and stereo buffers are
+        processed; any other channel count is left untouched.
+    */
+    inline void process(float* const* channels, int numChannels, int numSamples, const RoutingMatrix& m)
+    {
+        if (numChannels == 1)
+        {
+            float* mono = channels[0];
+
+            for (int sample = 0; sample < numSamples; ++sample)
+                mono[sample] *= m.mono;
+        }
+        else if (numChannels == 2)
+        {
+            float* left = channels[0];
+            float* right = channels[1];
+
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                float sampleLeft = left[sample];
+                float sampleRight = right[sample];
+
+                left[sample] = m.leftFromLeft * sampleLeft + m.leftFromRight * sampleRight;
+                right[sample] = m.rightFromLeft * sampleLeft + m.rightFromRight * sampleRight;
+            }
+        }
+    }
+
+    inline void process(float* const* channels, int numChannels, int numSamples, const Parameters& params)
+    {
+        process(channels, numChannels, numSamples, makeRoutingMatrix(params));
+    }
+}
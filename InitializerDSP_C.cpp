@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    C interface to the Initializer DSP core.
+
+  ==============================================================================
+*/
+
+#include "InitializerDSP_C.h"
+#include "InitializerDSP.h"
+#include "InitializerPCM.h"
+
+static InitializerDSP::Parameters toParameters(const initializer_params& params)
+{
+    InitializerDSP::Parameters result;
+    result.gainDecibels = params.gain_db;
+    result.phaseReverse = params.phase_reverse != 0;
+    result.stereoFlip = params.stereo_flip != 0;
+
+    switch (params.solo)
+    {
+        case INITIALIZER_SOLO_MID:   result.solo = InitializerDSP::SoloMode::mid; break;
+        case INITIALIZER_SOLO_SIDE:  result.solo = InitializerDSP::SoloMode::side; break;
+        case INITIALIZER_SOLO_LEFT:  result.solo = InitializerDSP::SoloMode::left; break;
+        case INITIALIZER_SOLO_RIGHT: result.solo = InitializerDSP::SoloMode::right; break;
+        default:                     result.solo = InitializerDSP::SoloMode::stereo; break;
+    }
+
+    return result;
+}
+
+void initializer_params_init(initializer_params* params)
+{
+    if (params == nullptr)
+        return;
+
+    params->gain_db = 0.0f;
+    params->phase_reverse = 0;
+    params->stereo_flip = 0;
+    params->solo = INITIALIZER_SOLO_STEREO;
+}
+
+void initializer_process(float* const* channels, int num_channels, int num_samples,
+                         const initializer_params* params)
+{
+    if (channels == nullptr || params == nullptr || num_samples <= 0)
+        return;
+
+    InitializerDSP::process(channels, num_channels, num_samples, toParameters(*params));
+}
+
+void initializer_process_int16(const int16_t* input, int16_t* output, int num_channels, ptrdiff_t num_frames,
+                               const initializer_params* params)
+{
+    if (input == nullptr || output == nullptr || params == nullptr || num_frames <= 0)
+        return;
+
+    InitializerDSP::processInt16(input, output, num_channels, num_frames, toParameters(*params));
+}
+
+void initializer_process_int24(const uint8_t* input, uint8_t* output, int num_channels, ptrdiff_t num_frames,
+                               const initializer_params* params)
+{
+    if (input == nullptr || output == nullptr || params == nullptr || num_frames <= 0)
+        return;
+
+    InitializerDSP::processInt24(input, output, num_channels, num_frames, toParameters(*params));
+}
+
+void initializer_process_int32(const int32_t* input, int32_t* output, int num_channels, ptrdiff_t num_frames,
+                               const initializer_params* params)
+{
+    if (input == nullptr || output == nullptr || params == nullptr || num_frames <= 0)
+        return;
+
+    InitializerDSP::processInt32(input, output, num_channels, num_frames, toParameters(*params));
+}
@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    C interface to the Initializer DSP core, for embedding in non-JUCE hosts.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum initializer_solo_mode
+{
+    INITIALIZER_SOLO_STEREO = 0,
+    INITIALIZER_SOLO_MID,
+    INITIALIZER_SOLO_SIDE,
+    INITIALIZER_SOLO_LEFT,
+    INITIALIZER_SOLO_RIGHT
+} initializer_solo_mode;
+
+typedef struct initializer_params
+{
+    float gain_db;
+    int phase_reverse;   /* non-zero to invert polarity */
+    int stereo_flip;     /* non-zero to swap left and right; ignored when phase_reverse is set */
+    int solo;            /* one of initializer_solo_mode */
+} initializer_params;
+
+/** Fills params with the plugin defaults (0 dB, no polarity change, stereo). */
+void initializer_params_init(initializer_params* params);
+
+/**
+    Processes num_samples samples in place. channels points to num_channels
+    planar float buffers; only mono and stereo are processed.
+*/
+void initializer_process(float* const* channels, int num_channels, int num_samples,
+                         const initializer_params* params);
+
+/**
+    Processes interleaved integer PCM straight from input to output (which may
+    be the same buffer) without going through float buffers. 24-bit samples are
+    packed little-endian, 3 bytes each. Results are saturated to the format.
+*/
+void initializer_process_int16(const int16_t* input, int16_t* output, int num_channels, ptrdiff_t num_frames,
+                               const initializer_params* params);
+void initializer_process_int24(const uint8_t* input, uint8_t* output, int num_channels, ptrdiff_t num_frames,
+                               const initializer_params* params);
+void initializer_process_int32(const int32_t* input, int32_t* output, int num_channels, ptrdiff_t num_frames,
+                               const initializer_params* params);
+
+#ifdef __cplusplus
+}
+#endif
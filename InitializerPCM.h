@@ -0,0 +1,309 @@
+/*
+  ==============================================================================
+
+    Integer PCM kernels for the Initializer DSP core.
+
+    These apply the routing matrix directly to interleaved int16 / packed
+    int24 / int32 PCM, without converting to planar float buffers first.
+    Input and output are plain pointers, so the input can come straight from
+    a memory-mapped file. Output may be the same buffer as input, but the two
+    must not partially overlap.
+
+    Results are rounded to nearest and saturated to the range of the sample
+    format.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "InitializerDSP.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define INITIALIZER_PCM_SSE2 1
+ #include <emmintrin.h>
+#else
+ #define INITIALIZER_PCM_SSE2 0
+#endif
+
+namespace InitializerDSP
+{
+    namespace detail
+    {
+        // std::lrint is an out-of-line libm call because of errno, so round inline instead
+        inline std::int32_t roundToInt(float value)
+        {
+#if INITIALIZER_PCM_SSE2
+            return _mm_cvtss_si32(_mm_set_ss(value));
+#else
+            return (std::int32_t) (value + (value < 0.0f ? -0.5f : 0.5f));
+#endif
+        }
+
+        inline std::int32_t roundToInt(double value)
+        {
+#if INITIALIZER_PCM_SSE2
+            return _mm_cvtsd_si32(_mm_set_sd(value));
+#else
+            return (std::int32_t) (value + (value < 0.0 ? -0.5 : 0.5));
+#endif
+        }
+
+        template <typename Real>
+        inline std::int32_t roundAndSaturate(Real value, Real lowest, Real highest)
+        {
+            value = value < lowest ? lowest : (value > highest ? highest : value);
+            return roundToInt(value);
+        }
+
+        /** Plain per-sample loop, used for formats without a SIMD path and for the remaining frames. */
+        template <typename Real, typename Load, typename Store>
+        inline void processFrames(std::ptrdiff_t startFrame, std::ptrdiff_t numFrames, int numChannels, const RoutingMatrix& m,
+                                  Real lowest, Real highest, Load load, Store store)
+        {
+            if (numChannels == 1)
+            {
+                for (std::ptrdiff_t frame = startFrame; frame < numFrames; ++frame)
+                    store(frame, roundAndSaturate((Real) m.mono * load(frame), lowest, highest));
+            }
+            else
+            {
+                for (std::ptrdiff_t frame = startFrame; frame < numFrames; ++frame)
+                {
+                    Real sampleLeft = load(2 * frame);
+                    Real sampleRight = load(2 * frame + 1);
+
+                    store(2 * frame, roundAndSaturate((Real) m.leftFromLeft * sampleLeft + (Real) m.leftFromRight * sampleRight, lowest, highest));
+                    store(2 * frame + 1, roundAndSaturate((Real) m.rightFromLeft * sampleLeft + (Real) m.rightFromRight * sampleRight, lowest, highest));
+                }
+            }
+        }
+
+        /** Channel layouts other than mono and stereo are passed through unchanged, like the float path. */
+        inline bool passThroughIfUnsupported(const void* input, void* output, int numChannels, std::ptrdiff_t numFrames, int bytesPerSample)
+        {
+            if (numChannels == 1 || numChannels == 2)
+                return false;
+
+            if (input != output && numChannels > 0 && numFrames > 0)
+                std::memmove(output, input, (std::size_t) numChannels * (std::size_t) numFrames * (std::size_t) bytesPerSample);
+
+            return true;
+        }
+
+#if INITIALIZER_PCM_SSE2
+        /** Sign-extends 4 packed 24-bit samples into 32-bit lanes. Reads 14 bytes. */
+        inline __m128i loadInt24x4(const std::uint8_t* bytes)
+        {
+            const __m128i evenLanes = _mm_set_epi32(0, -1, 0, -1);
+
+            // each 64-bit half now holds two samples, at bits 0-23 and 24-47
+            __m128i packed = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*) bytes),
+                                                _mm_loadl_epi64((const __m128i*) (bytes + 6)));
+
+            // shift the first sample of each half up by 8 and the second by 16, so that every sample
+            // ends up in the top 24 bits of its own lane, then shift back down to sign-extend
+            __m128i spread = _mm_or_si128(_mm_and_si128(evenLanes, _mm_slli_epi64(packed, 8)),
+                                          _mm_andnot_si128(evenLanes, _mm_slli_epi64(packed, 16)));
+            return _mm_srai_epi32(spread, 8);
+        }
+
+        /** Packs 4 lanes that are already within 24-bit range into 12 bytes. Writes exactly 12 bytes. */
+        inline void storeInt24x4(std::uint8_t* bytes, __m128i samples)
+        {
+            const __m128i evenLanes = _mm_set_epi32(0, -1, 0, -1);
+            const __m128i lowSixBytes = _mm_set_epi32(0, 0, 0x0000ffff, -1);
+
+            samples = _mm_and_si128(samples, _mm_set1_epi32(0x00ffffff));
+
+            // close the gap inside each 64-bit half, leaving the samples in bytes 0-5 and 8-13
+            __m128i halves = _mm_or_si128(_mm_and_si128(evenLanes, samples),
+                                          _mm_srli_epi64(_mm_andnot_si128(evenLanes, samples), 8));
+
+            // then move the upper half down to bytes 6-11
+            __m128i packed = _mm_or_si128(_mm_and_si128(lowSixBytes, halves),
+                                          _mm_srli_si128(_mm_andnot_si128(lowSixBytes, halves), 2));
+
+            _mm_storel_epi64((__m128i*) bytes, packed);
+
+            std::int32_t last = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+            std::memcpy(bytes + 8, &last, sizeof(last));
+        }
+#endif
+    }
+
+    //==============================================================================
+    /** Interleaved signed 16-bit PCM. */
+    inline void processInt16(const std::int16_t* input, std::int16_t* output, int numChannels, std::ptrdiff_t numFrames, const RoutingMatrix& m)
+    {
+        if (detail::passThroughIfUnsupported(input, output, numChannels, numFrames, 2))
+            return;
+
+        std::ptrdiff_t frame = 0;
+
+#if INITIALIZER_PCM_SSE2
+        // clamp before converting: an out-of-range float would turn into INT_MIN rather than saturate
+        const __m128 lowest = _mm_set1_ps(-32768.0f);
+        const __m128 highest = _mm_set1_ps(32767.0f);
+
+        if (numChannels == 1)
+        {
+            const __m128 gain = _mm_set1_ps(m.mono);
+
+            for (; frame + 8 <= numFrames; frame += 8)
+            {
+                __m128i samples = _mm_loadu_si128((const __m128i*) (input + frame));
+                __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16));
+                __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16));
+
+                __m128 outLo = _mm_min_ps(_mm_max_ps(_mm_mul_ps(lo, gain), lowest), highest);
+                __m128 outHi = _mm_min_ps(_mm_max_ps(_mm_mul_ps(hi, gain), lowest), highest);
+
+                __m128i result = _mm_packs_epi32(_mm_cvtps_epi32(outLo), _mm_cvtps_epi32(outHi));
+                _mm_storeu_si128((__m128i*) (output + frame), result);
+            }
+        }
+        else
+        {
+            // lanes hold L R L R, so each output is direct * sample + cross * (other channel of the same frame)
+            const __m128 direct = _mm_setr_ps(m.leftFromLeft, m.rightFromRight, m.leftFromLeft, m.rightFromRight);
+            const __m128 cross = _mm_setr_ps(m.leftFromRight, m.rightFromLeft, m.leftFromRight, m.rightFromLeft);
+
+            for (; frame + 4 <= numFrames; frame += 4)
+            {
+                __m128i samples = _mm_loadu_si128((const __m128i*) (input + 2 * frame));
+                __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16));
+                __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16));
+
+                __m128 outLo = _mm_add_ps(_mm_mul_ps(direct, lo), _mm_mul_ps(cross, _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(2, 3, 0, 1))));
+                __m128 outHi = _mm_add_ps(_mm_mul_ps(direct, hi), _mm_mul_ps(cross, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(2, 3, 0, 1))));
+
+                outLo = _mm_min_ps(_mm_max_ps(outLo, lowest), highest);
+                outHi = _mm_min_ps(_mm_max_ps(outHi, lowest), highest);
+
+                __m128i result = _mm_packs_epi32(_mm_cvtps_epi32(outLo), _mm_cvtps_epi32(outHi));
+                _mm_storeu_si128((__m128i*) (output + 2 * frame), result);
+            }
+        }
+#endif
+
+        detail::processFrames<float>(frame, numFrames, numChannels, m, -32768.0f, 32767.0f,
+                                     [input](std::ptrdiff_t i) { return (float) input[i]; },
+                                     [output](std::ptrdiff_t i, std::int32_t value) { output[i] = (std::int16_t) value; });
+    }
+
+    //==============================================================================
+    /** Interleaved signed 24-bit PCM, packed little-endian into 3 bytes per sample. */
+    inline void processInt24(const std::uint8_t* input, std::uint8_t* output, int numChannels, std::ptrdiff_t numFrames, const RoutingMatrix& m)
+    {
+        if (detail::passThroughIfUnsupported(input, output, numChannels, numFrames, 3))
+            return;
+
+        std::ptrdiff_t frame = 0;
+
+#if INITIALIZER_PCM_SSE2
+        const __m128 lowest = _mm_set1_ps(-8388608.0f);
+        const __m128 highest = _mm_set1_ps(8388607.0f);
+
+        // same lane layout as the int16 kernel; for mono there is no cross term
+        const __m128 direct = numChannels == 1 ? _mm_set1_ps(m.mono)
+                                               : _mm_setr_ps(m.leftFromLeft, m.rightFromRight, m.leftFromLeft, m.rightFromRight);
+        const __m128 cross = numChannels == 1 ? _mm_setzero_ps()
+                                              : _mm_setr_ps(m.leftFromRight, m.rightFromLeft, m.leftFromRight, m.rightFromLeft);
+
+        const std::ptrdiff_t totalSamples = numFrames * numChannels;
+        const std::ptrdiff_t framesPerBlock = 4 / numChannels;
+
+        // a block of 4 samples reads 14 bytes, so keep at least 5 samples ahead of the end
+        for (; frame * numChannels + 5 <= totalSamples; frame += framesPerBlock)
+        {
+            const std::ptrdiff_t offset = 3 * frame * numChannels;
+
+            __m128 samples = _mm_cvtepi32_ps(detail::loadInt24x4(input + offset));
+            __m128 result = _mm_add_ps(_mm_mul_ps(direct, samples), _mm_mul_ps(cross, _mm_shuffle_ps(samples, samples, _MM_SHUFFLE(2, 3, 0, 1))));
+            result = _mm_min_ps(_mm_max_ps(result, lowest), highest);
+
+            detail::storeInt24x4(output + offset, _mm_cvtps_epi32(result));
+        }
+#endif
+
+        detail::processFrames<float>(frame, numFrames, numChannels, m, -8388608.0f, 8388607.0f,
+                                     [input](std::ptrdiff_t i)
+                                     {
+                                         const std::uint8_t* bytes = input + 3 * i;
+                                         auto packed = (std::uint32_t) bytes[0] << 8 | (std::uint32_t) bytes[1] << 16 | (std::uint32_t) bytes[2] << 24;
+                                         return (float) ((std::int32_t) packed >> 8);
+                                     },
+                                     [output](std::ptrdiff_t i, std::int32_t value)
+                                     {
+                                         std::uint8_t* bytes = output + 3 * i;
+                                         bytes[0] = (std::uint8_t) value;
+                                         bytes[1] = (std::uint8_t) (value >> 8);
+                                         bytes[2] = (std::uint8_t) (value >> 16);
+                                     });
+    }
+
+    //==============================================================================
+    /** Interleaved signed 32-bit PCM. Computed in double so no precision is lost to a float mantissa. */
+    inline void processInt32(const std::int32_t* input, std::int32_t* output, int numChannels, std::ptrdiff_t numFrames, const RoutingMatrix& m)
+    {
+        if (detail::passThroughIfUnsupported(input, output, numChannels, numFrames, 4))
+            return;
+
+        std::ptrdiff_t frame = 0;
+
+#if INITIALIZER_PCM_SSE2
+        const __m128d lowest = _mm_set1_pd(-2147483648.0);
+        const __m128d highest = _mm_set1_pd(2147483647.0);
+
+        if (numChannels == 1)
+        {
+            const __m128d gain = _mm_set1_pd(m.mono);
+
+            for (; frame + 2 <= numFrames; frame += 2)
+            {
+                __m128d samples = _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i*) (input + frame)));
+                __m128d result = _mm_min_pd(_mm_max_pd(_mm_mul_pd(samples, gain), lowest), highest);
+                _mm_storel_epi64((__m128i*) (output + frame), _mm_cvtpd_epi32(result));
+            }
+        }
+        else
+        {
+            const __m128d direct = _mm_setr_pd(m.leftFromLeft, m.rightFromRight);
+            const __m128d cross = _mm_setr_pd(m.leftFromRight, m.rightFromLeft);
+
+            for (; frame < numFrames; ++frame)
+            {
+                __m128d samples = _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i*) (input + 2 * frame)));
+                __m128d result = _mm_add_pd(_mm_mul_pd(direct, samples), _mm_mul_pd(cross, _mm_shuffle_pd(samples, samples, 1)));
+                result = _mm_min_pd(_mm_max_pd(result, lowest), highest);
+                _mm_storel_epi64((__m128i*) (output + 2 * frame), _mm_cvtpd_epi32(result));
+            }
+        }
+#endif
+
+        detail::processFrames<double>(frame, numFrames, numChannels, m, -2147483648.0, 2147483647.0,
+                                      [input](std::ptrdiff_t i) { return (double) input[i]; },
+                                      [output](std::ptrdiff_t i, std::int32_t value) { output[i] = value; });
+    }
+
+    //==============================================================================
+    inline void processInt16(const std::int16_t* input, std::int16_t* output, int numChannels, std::ptrdiff_t numFrames, const Parameters& params)
+    {
+        processInt16(input, output, numChannels, numFrames, makeRoutingMatrix(params));
+    }
+
+    inline void processInt24(const std::uint8_t* input, std::uint8_t* output, int numChannels, std::ptrdiff_t numFrames, const Parameters& params)
+    {
+        processInt24(input, output, numChannels, numFrames, makeRoutingMatrix(params));
+    }
+
+    inline void processInt32(const std::int32_t* input, std::int32_t* output, int numChannels, std::ptrdiff_t numFrames, const Parameters& params)
+    {
+        processInt32(input, output, numChannels, numFrames, makeRoutingMatrix(params));
+    }
+}
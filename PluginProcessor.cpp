@@ -139,87 +139,24 @@ void InitializerAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
-        auto sliderGainValue = treeState.getRawParameterValue(GAIN_ID);
-        auto dbToGain = juce::Decibels::decibelsToGain(sliderGainValue->load());
-
-        // mono in
-        if (buffer.getNumChannels() == 1)
-        {
-            float sampleLeft = buffer.getSample(0, sample);
-            float new_sampleLeft = sampleLeft;
-
-            // phase reverse in mono
-            if (getPhaseReverse())
-            {
-                new_sampleLeft = -sampleLeft;
-            }
-
-            buffer.setSample(0, sample, new_sampleLeft * dbToGain);
-        }
-
-        // stereo in
-        if (buffer.getNumChannels() == 2)
-        {
-            float sampleLeft = buffer.getSample(0, sample);
-            float sampleRight = buffer.getSample(1, sample);
-
-            float pSelectedSampleLeft = sampleLeft;
-            float pSelectedSampleRight = sampleRight;
-
-            float newSampleLeft = sampleLeft;
-            float newSampleRight = sampleRight;
-
-            // mid solo
-            if (getMidSolo()) {
-                pSelectedSampleLeft = (sampleLeft + sampleRight) / 2.0;
-                pSelectedSampleRight = (sampleLeft + sampleRight) / 2.0;
-            }
-
-            // side solo
-            if (getSideSolo()) {
-                pSelectedSampleLeft = (sampleLeft - sampleRight) / 2.0;
-                pSelectedSampleRight = -(sampleLeft - sampleRight) / 2.0;
-            }
-
-            //left solo
-            if (getLeftSolo()) {
-                pSelectedSampleLeft = sampleLeft;
-                pSelectedSampleRight = 0.0;
-            }
-
-            //right solo
-            if (getRightSolo()) {
-                pSelectedSampleLeft = 0.0;;
-                pSelectedSampleRight = sampleRight;
-            }
-
-            //stereo
-            if (getStereoSolo()) {
-                pSelectedSampleLeft = sampleLeft;
-                pSelectedSampleRight = sampleRight;
-            }
-
-            // phase reverse in stereo
-            if (getPhaseReverse())
-            {
-                newSampleLeft = -pSelectedSampleLeft;
-                newSampleRight = -pSelectedSampleRight;
-            }
-            else if (getStereoFlip())
-            {
-                newSampleLeft = pSelectedSampleRight;
-                newSampleRight = pSelectedSampleLeft;
-            }
-            else {
-                newSampleLeft = pSelectedSampleLeft;
-                newSampleRight = pSelectedSampleRight;
-            }
-
-            buffer.setSample(0, sample, newSampleLeft * dbToGain);
-            buffer.setSample(1, sample, newSampleRight * dbToGain);
-        }
-    }
+    InitializerDSP::Parameters params;
+    params.gainDecibels = treeState.getRawParameterValue(GAIN_ID)->load();
+    params.phaseReverse = getPhaseReverse();
+    params.stereoFlip = getStereoFlip();
+
+    // if several solo flags are set: stereo > right > left > side > mid
+    if (getStereoSolo())
+        params.solo = InitializerDSP::SoloMode::stereo;
+    else if (getRightSolo())
+        params.solo = InitializerDSP::SoloMode::right;
+    else if (getLeftSolo())
+        params.solo = InitializerDSP::SoloMode::left;
+    else if (getSideSolo())
+        params.solo = InitializerDSP::SoloMode::side;
+    else if (getMidSolo())
+        params.solo = InitializerDSP::SoloMode::mid;
+
+    InitializerDSP::process(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), buffer.getNumSamples(), params);
 }
 
 //==============================================================================
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "InitializerDSP.h"
 #define GAIN_ID "gain"
 #define GAIN_NAME "Gain"
 #define PHASE_REV_ID "phase_reverse"
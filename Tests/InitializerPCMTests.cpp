@@ -0,0 +1,267 @@
+/*
+  ==============================================================================
+
+    Checks the integer PCM kernels against the float processing in
+    InitializerDSP::process.
+
+  ==============================================================================
+*/
+
+#include "InitializerDSP.h"
+#include "InitializerDSP_C.h"
+#include "InitializerPCM.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const char* format, const char* what, double expected, double actual)
+    {
+        if (condition)
+            return;
+
+        if (++failures <= 20)
+            std::printf(format, what, expected, actual);
+    }
+
+    //==============================================================================
+    struct Int16Format
+    {
+        static constexpr const char* name = "int16";
+        static constexpr double lowest = -32768.0;
+        static constexpr double highest = 32767.0;
+        static constexpr int bytesPerSample = 2;
+
+        static double read(const std::vector<std::uint8_t>& data, std::size_t i)
+        {
+            return (std::int16_t) (data[2 * i] | data[2 * i + 1] << 8);
+        }
+
+        static void write(std::vector<std::uint8_t>& data, std::size_t i, std::int32_t value)
+        {
+            data[2 * i] = (std::uint8_t) value;
+            data[2 * i + 1] = (std::uint8_t) (value >> 8);
+        }
+
+        static void process(const std::uint8_t* input, std::uint8_t* output, int numChannels, std::ptrdiff_t numFrames, const InitializerDSP::Parameters& params)
+        {
+            InitializerDSP::processInt16((const std::int16_t*) input, (std::int16_t*) output, numChannels, numFrames, params);
+        }
+    };
+
+    struct Int24Format
+    {
+        static constexpr const char* name = "int24";
+        static constexpr double lowest = -8388608.0;
+        static constexpr double highest = 8388607.0;
+        static constexpr int bytesPerSample = 3;
+
+        static double read(const std::vector<std::uint8_t>& data, std::size_t i)
+        {
+            auto packed = (std::uint32_t) data[3 * i] << 8 | (std::uint32_t) data[3 * i + 1] << 16 | (std::uint32_t) data[3 * i + 2] << 24;
+            return (std::int32_t) packed >> 8;
+        }
+
+        static void write(std::vector<std::uint8_t>& data, std::size_t i, std::int32_t value)
+        {
+            data[3 * i] = (std::uint8_t) value;
+            data[3 * i + 1] = (std::uint8_t) (value >> 8);
+            data[3 * i + 2] = (std::uint8_t) (value >> 16);
+        }
+
+        static void process(const std::uint8_t* input, std::uint8_t* output, int numChannels, std::ptrdiff_t numFrames, const InitializerDSP::Parameters& params)
+        {
+            InitializerDSP::processInt24(input, output, numChannels, numFrames, params);
+        }
+    };
+
+    struct Int32Format
+    {
+        static constexpr const char* name = "int32";
+        static constexpr double lowest = -2147483648.0;
+        static constexpr double highest = 2147483647.0;
+        static constexpr int bytesPerSample = 4;
+
+        static double read(const std::vector<std::uint8_t>& data, std::size_t i)
+        {
+            return (std::int32_t) ((std::uint32_t) data[4 * i] | (std::uint32_t) data[4 * i + 1] << 8
+                                   | (std::uint32_t) data[4 * i + 2] << 16 | (std::uint32_t) data[4 * i + 3] << 24);
+        }
+
+        static void write(std::vector<std::uint8_t>& data, std::size_t i, std::int32_t value)
+        {
+            for (int byte = 0; byte < 4; ++byte)
+                data[4 * i + byte] = (std::uint8_t) ((std::uint32_t) value >> (8 * byte));
+        }
+
+        static void process(const std::uint8_t* input, std::uint8_t* output, int numChannels, std::ptrdiff_t numFrames, const InitializerDSP::Parameters& params)
+        {
+            InitializerDSP::processInt32((const std::int32_t*) input, (std::int32_t*) output, numChannels, numFrames, params);
+        }
+    };
+
+    //==============================================================================
+    /** Interleaved test signal: random values with the extremes of the format mixed in. */
+    template <typename Format>
+    std::vector<std::uint8_t> makeInput(int numChannels, int numFrames, bool fullScale, std::mt19937& random)
+    {
+        std::uniform_real_distribution<double> distribution(Format::lowest, Format::highest);
+        std::vector<std::uint8_t> data((std::size_t) numChannels * (std::size_t) numFrames * Format::bytesPerSample);
+
+        for (std::size_t i = 0; i < (std::size_t) numChannels * (std::size_t) numFrames; ++i)
+        {
+            double value = distribution(random);
+
+            if (fullScale)
+                value = (i % 3 == 0) ? Format::lowest : ((i % 3 == 1) ? Format::highest : -Format::highest);
+            else if (i % 11 == 0)
+                value = Format::lowest;
+            else if (i % 13 == 0)
+                value = Format::highest;
+
+            Format::write(data, i, (std::int32_t) value);
+        }
+
+        return data;
+    }
+
+    /** Runs InitializerDSP::process on planar float copies of the input. */
+    template <typename Format>
+    std::vector<double> makeReference(const std::vector<std::uint8_t>& input, int numChannels, int numFrames, const InitializerDSP::Parameters& params)
+    {
+        std::vector<std::vector<float>> planar((std::size_t) numChannels, std::vector<float>((std::size_t) numFrames));
+        std::vector<float*> channels;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            for (int frame = 0; frame < numFrames; ++frame)
+                planar[(std::size_t) channel][(std::size_t) frame] = (float) Format::read(input, (std::size_t) frame * numChannels + channel);
+
+            channels.push_back(planar[(std::size_t) channel].data());
+        }
+
+        InitializerDSP::process(channels.data(), numChannels, numFrames, params);
+
+        std::vector<double> reference;
+
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                double value = planar[(std::size_t) channel][(std::size_t) frame];
+                value = value < Format::lowest ? Format::lowest : (value > Format::highest ? Format::highest : value);
+                reference.push_back(std::nearbyint(value));
+            }
+        }
+
+        return reference;
+    }
+
+    template <typename Format>
+    void testFormat(std::mt19937& random)
+    {
+        const int frameCounts[] = { 1, 2, 3, 5, 7, 9, 37, 1001 };
+        const float gains[] = { -60.0f, -6.0f, 0.0f, 12.0f };
+        const InitializerDSP::SoloMode soloModes[] = { InitializerDSP::SoloMode::stereo, InitializerDSP::SoloMode::mid,
+                                                       InitializerDSP::SoloMode::side, InitializerDSP::SoloMode::left,
+                                                       InitializerDSP::SoloMode::right };
+
+        for (int numChannels = 1; numChannels <= 3; ++numChannels)
+        for (int numFrames : frameCounts)
+        for (bool fullScale : { false, true })
+        for (float gain : gains)
+        for (auto solo : soloModes)
+        for (bool phaseReverse : { false, true })
+        for (bool stereoFlip : { false, true })
+        {
+            InitializerDSP::Parameters params;
+            params.gainDecibels = gain;
+            params.phaseReverse = phaseReverse;
+            params.stereoFlip = stereoFlip;
+            params.solo = solo;
+
+            auto input = makeInput<Format>(numChannels, numFrames, fullScale, random);
+            auto reference = makeReference<Format>(input, numChannels, numFrames, params);
+
+            std::vector<std::uint8_t> output(input.size());
+            Format::process(input.data(), output.data(), numChannels, numFrames, params);
+
+            // the float reference itself loses precision on 32-bit input
+            double tolerance = 1.0 + (Format::highest > 8388607.0 ? 1.0e-6 * Format::highest * InitializerDSP::decibelsToGain(gain) : 0.0);
+
+            for (std::size_t i = 0; i < reference.size(); ++i)
+            {
+                double actual = Format::read(output, i);
+
+                if (numChannels > 2)
+                    check(actual == Format::read(input, i), "%s passthrough: expected %.0f, got %.0f\n", Format::name, Format::read(input, i), actual);
+                else
+                    check(std::abs(actual - reference[i]) <= tolerance, "%s: expected %.0f, got %.0f\n", Format::name, reference[i], actual);
+            }
+
+            std::vector<std::uint8_t> inPlace = input;
+            Format::process(inPlace.data(), inPlace.data(), numChannels, numFrames, params);
+            check(inPlace == output, "%s in place: differs from out of place (%.0f, %.0f)\n", Format::name, 0.0, 0.0);
+        }
+    }
+
+    //==============================================================================
+    void testCInterface()
+    {
+        initializer_params params;
+        initializer_params_init(&params);
+        params.phase_reverse = 1;
+
+        const std::int16_t input16[] = { 100, -200, 32767, -32768, 5, 6 };
+        std::int16_t output16[6] = {};
+        initializer_process_int16(input16, output16, 2, 3, &params);
+
+        const double expected16[] = { -100, 200, -32767, 32767, -5, -6 };
+
+        for (int i = 0; i < 6; ++i)
+            check(output16[i] == expected16[i], "%s: expected %.0f, got %.0f\n", "C int16", expected16[i], output16[i]);
+
+        const std::uint8_t input24[] = { 0x01, 0x00, 0x80, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff };
+        std::uint8_t output24[9] = {};
+        initializer_process_int24(input24, output24, 1, 3, &params);
+
+        const std::uint8_t expected24[] = { 0xff, 0xff, 0x7f, 0x01, 0x00, 0x80, 0x02, 0x00, 0x00 };
+
+        for (int i = 0; i < 9; ++i)
+            check(output24[i] == expected24[i], "%s: expected %.0f, got %.0f\n", "C int24 byte", expected24[i], output24[i]);
+
+        const std::int32_t input32[] = { INT32_MIN, INT32_MAX, 7 };
+        std::int32_t output32[3] = {};
+        initializer_process_int32(input32, output32, 1, 3, &params);
+
+        const double expected32[] = { 2147483647.0, -2147483647.0, -7.0 };
+
+        for (int i = 0; i < 3; ++i)
+            check(output32[i] == expected32[i], "%s: expected %.0f, got %.0f\n", "C int32", expected32[i], output32[i]);
+    }
+}
+
+int main()
+{
+    std::mt19937 random(2024);
+
+    testFormat<Int16Format>(random);
+    testFormat<Int24Format>(random);
+    testFormat<Int32Format>(random);
+    testCInterface();
+
+    if (failures > 0)
+    {
+        std::printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    std::printf("All integer PCM checks passed\n");
+    return 0;
+}